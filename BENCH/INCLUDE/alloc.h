@@ -0,0 +1 @@
+#include "../DOSSHIM.H"